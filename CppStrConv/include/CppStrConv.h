@@ -48,12 +48,54 @@
 #include <Windows.h>
 #endif
 
+// SSE2 is baseline on x86-64, so the vectorized kernels are enabled there by
+// default. Define BENE_CPPSTRCONV_NO_SIMD to force the scalar code path.
+#if !defined(BENE_CPPSTRCONV_NO_SIMD) &&                          \
+    (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BENE_CPPSTRCONV_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace bene {
 
 static const std::array<char, 3> BOM_UTF8 = {'\xef', '\xbb', '\xbf'};
 static const std::array<char, 2> BOM_UTF16BE = {'\xfe', '\xff'};
 static const std::array<char, 2> BOM_UTF16LE = {'\xff', '\xfe'};
 
+// How characters that do not exist in the target encoding are handled.
+enum class UnmappablePolicy {
+  Replace,  // Write the replacement character instead
+  Skip,     // Drop the character from the output
+  Throw     // Throw std::invalid_argument
+};
+
+// Describes the unmappable characters found during a conversion.
+struct ConversionReport {
+  size_t unmappableCount = 0;  // Number of unmappable characters
+  size_t firstUnmappable =
+      std::string::npos;  // Input index of the first one, or npos
+};
+
+// Grapheme_Cluster_Break classes used by the truncating conversions.
+enum class GraphemeBreak {
+  Other,
+  CR,
+  LF,
+  Control,
+  Extend,
+  ZWJ,
+  RegionalIndicator,
+  Prepend,
+  SpacingMark,
+  L,
+  V,
+  T,
+  LV,
+  LVT,
+  Pictographic  // Extended_Pictographic
+};
+
 class CppStrConv {
  public:
   static std::string u16_to_u8(const std::u16string& str) {
@@ -106,6 +148,36 @@ class CppStrConv {
 #endif
   }
 
+  // Converts as many whole code points as fit in maxBytes and stores the
+  // number of input units used in consumed. With graphemeBoundary, extended
+  // grapheme clusters are not split.
+  static std::string u16_to_u8_truncated(const std::u16string& str,
+                                         size_t maxBytes,
+                                         size_t& consumed,
+                                         bool graphemeBoundary = false) {
+    std::string u8str;
+    consumed = convert_truncated(str, maxBytes, graphemeBoundary, u8str);
+    return u8str;
+  }
+
+  static std::string u32_to_u8_truncated(const std::u32string& str,
+                                         size_t maxBytes,
+                                         size_t& consumed,
+                                         bool graphemeBoundary = false) {
+    std::string u8str;
+    consumed = convert_truncated(str, maxBytes, graphemeBoundary, u8str);
+    return u8str;
+  }
+
+  static std::u16string u8_to_u16_truncated(const std::string& str,
+                                            size_t maxUnits,
+                                            size_t& consumed,
+                                            bool graphemeBoundary = false) {
+    std::u16string u16str;
+    consumed = convert_truncated(str, maxUnits, graphemeBoundary, u16str);
+    return u16str;
+  }
+
   static std::u16string u32_to_u16(const std::u32string& str) {
     return u8_to_u16(u32_to_u8(str));
   }
@@ -271,23 +343,31 @@ class CppStrConv {
   }
 
   static std::vector<char> u16_to_us_ascii_bytes(const std::u16string& str) {
-    auto length = str.size();
-    std::vector<char> bytes;
-    bytes.resize(length);
-    for (size_t i = 0; i < length; ++i) {
-      bytes[i] = (str[i] <= 0x7F) ? static_cast<char>(str[i]) : '?';
-    }
-    return bytes;
+    ConversionReport report;
+    return u16_to_us_ascii_bytes(str, report);
+  }
+
+  static std::vector<char> u16_to_us_ascii_bytes(
+      const std::u16string& str,
+      ConversionReport& report,
+      UnmappablePolicy policy = UnmappablePolicy::Replace,
+      char replacement = '?') {
+    report = ConversionReport();
+    return narrow_u16(str, 0xff80, report, policy, replacement);
   }
 
   static std::vector<char> u16_to_iso_8859_1_bytes(const std::u16string& str) {
-    auto length = str.size();
-    std::vector<char> bytes;
-    bytes.resize(length);
-    for (size_t i = 0; i < length; ++i) {
-      bytes[i] = (str[i] <= 0xff) ? static_cast<char>(str[i]) : '?';
-    }
-    return bytes;
+    ConversionReport report;
+    return u16_to_iso_8859_1_bytes(str, report);
+  }
+
+  static std::vector<char> u16_to_iso_8859_1_bytes(
+      const std::u16string& str,
+      ConversionReport& report,
+      UnmappablePolicy policy = UnmappablePolicy::Replace,
+      char replacement = '?') {
+    report = ConversionReport();
+    return narrow_u16(str, 0xff00, report, policy, replacement);
   }
 
   static std::vector<char> u16_to_iso_10646_bytes(const std::u16string& str) {
@@ -347,20 +427,24 @@ class CppStrConv {
   }
 
   static std::u16string us_ascii_bytes_to_u16(const std::vector<char>& bytes) {
-    std::u16string u16str;
-    u16str.assign(bytes.begin(), bytes.end());
-    return u16str;
+    ConversionReport report;
+    return us_ascii_bytes_to_u16(bytes, report);
+  }
+
+  static std::u16string us_ascii_bytes_to_u16(
+      const std::vector<char>& bytes,
+      ConversionReport& report,
+      UnmappablePolicy policy = UnmappablePolicy::Replace,
+      char16_t replacement = u'?') {
+    report = ConversionReport();
+    return widen_bytes(bytes, true, report, policy, replacement);
   }
 
   static std::u16string iso_8859_1_bytes_to_u16(
       const std::vector<char>& bytes) {
-    auto length = bytes.size();
-    std::u16string u16str;
-    u16str.resize(length);
-    for (size_t i = 0; i < length; ++i) {
-      u16str[i] = bytes[i] & 0xff;
-    }
-    return u16str;
+    // Every byte is a valid ISO-8859-1 character
+    ConversionReport report;
+    return widen_bytes(bytes, false, report, UnmappablePolicy::Replace, u'?');
   }
 
   static std::u32string u32_bytes_to_u32(const std::vector<char>& bytes) {
@@ -485,6 +569,678 @@ class CppStrConv {
       }
     }
   }
+
+  // Narrows UTF-16 to a single-byte encoding. A code unit with any bit of
+  // mask set is unmappable, and a surrogate pair counts as one character.
+  static std::vector<char> narrow_u16(const std::u16string& str,
+                                      char16_t mask,
+                                      ConversionReport& report,
+                                      UnmappablePolicy policy,
+                                      char replacement) {
+    auto length = str.size();
+    std::vector<char> bytes;
+    bytes.resize(length);
+    size_t in = 0;
+    size_t out = 0;
+    while (in < length) {
+      size_t run = narrow_run(str.data() + in, length - in, mask,
+                              bytes.data() + out);
+      in += run;
+      out += run;
+      if (in == length) {
+        break;
+      }
+
+      if (report.unmappableCount++ == 0) {
+        report.firstUnmappable = in;
+      }
+      if (policy == UnmappablePolicy::Throw) {
+        throw std::invalid_argument(
+            "The string contains characters that cannot be mapped.");
+      } else if (policy == UnmappablePolicy::Replace) {
+        bytes[out++] = replacement;
+      }
+
+      bool isPair = str[in] >= 0xD800 && str[in] <= 0xDBFF &&
+                    in + 1 < length && str[in + 1] >= 0xDC00 &&
+                    str[in + 1] <= 0xDFFF;
+      in += isPair ? 2 : 1;
+    }
+    bytes.resize(out);
+    return bytes;
+  }
+
+  // Copies the leading code units that have no bit of mask set, one byte
+  // each, and returns how many were copied.
+  static size_t narrow_run(const char16_t* src,
+                           size_t length,
+                           char16_t mask,
+                           char* dst) {
+    size_t i = 0;
+#ifdef BENE_CPPSTRCONV_SSE2
+    const __m128i maskVec = _mm_set1_epi16(static_cast<short>(mask));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+      __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      __m128i hi =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+      __m128i unmappable = _mm_and_si128(_mm_or_si128(lo, hi), maskVec);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(unmappable, zero)) != 0xffff) {
+        break;
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                       _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < length && (src[i] & mask) == 0; ++i) {
+      dst[i] = static_cast<char>(src[i]);
+    }
+    return i;
+  }
+
+  // Widens single-byte text to UTF-16. With asciiOnly, bytes above 0x7F are
+  // unmappable; otherwise every byte is taken as ISO-8859-1.
+  static std::u16string widen_bytes(const std::vector<char>& bytes,
+                                    bool asciiOnly,
+                                    ConversionReport& report,
+                                    UnmappablePolicy policy,
+                                    char16_t replacement) {
+    auto length = bytes.size();
+    std::u16string u16str;
+    u16str.resize(length);
+    size_t in = 0;
+    size_t out = 0;
+    while (in < length) {
+      size_t run =
+          widen_run(bytes.data() + in, length - in, asciiOnly, &u16str[out]);
+      in += run;
+      out += run;
+      if (in == length) {
+        break;
+      }
+
+      if (report.unmappableCount++ == 0) {
+        report.firstUnmappable = in;
+      }
+      if (policy == UnmappablePolicy::Throw) {
+        throw std::invalid_argument(
+            "The bytes contain characters that cannot be mapped.");
+      } else if (policy == UnmappablePolicy::Replace) {
+        u16str[out++] = replacement;
+      }
+      ++in;
+    }
+    u16str.resize(out);
+    return u16str;
+  }
+
+  // Copies the leading mappable bytes, one code unit each, and returns how
+  // many were copied.
+  static size_t widen_run(const char* src,
+                          size_t length,
+                          bool asciiOnly,
+                          char16_t* dst) {
+    size_t i = 0;
+#ifdef BENE_CPPSTRCONV_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      if (asciiOnly && _mm_movemask_epi8(v) != 0) {
+        break;
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                       _mm_unpacklo_epi8(v, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8),
+                       _mm_unpackhi_epi8(v, zero));
+    }
+#endif
+    const unsigned char limit = asciiOnly ? 0x7F : 0xFF;
+    for (; i < length && static_cast<unsigned char>(src[i]) <= limit; ++i) {
+      dst[i] = static_cast<unsigned char>(src[i]);
+    }
+    return i;
+  }
+
+  // Appends code points from str to out until the next one would exceed
+  // maxUnits, and returns the number of input units consumed. Only the
+  // consumed prefix and the code point after it are decoded.
+  template <typename InString, typename OutString>
+  static size_t convert_truncated(const InString& str,
+                                  size_t maxUnits,
+                                  bool graphemeBoundary,
+                                  OutString& out) {
+    size_t in = 0;
+    size_t boundaryIn = 0;
+    size_t boundaryOut = 0;
+    GraphemeBreak prev = GraphemeBreak::Other;
+    size_t regionalIndicators = 0;
+    bool pictographic = false;
+    bool pictographicZwj = false;
+    while (in < str.size()) {
+      char32_t cp;
+      size_t length = decode_code_point(str, in, cp);
+      GraphemeBreak type =
+          graphemeBoundary ? grapheme_break(cp) : GraphemeBreak::Other;
+      if (!graphemeBoundary || in == 0 ||
+          is_grapheme_boundary(prev, type, pictographicZwj,
+                               regionalIndicators)) {
+        boundaryIn = in;
+        boundaryOut = out.size();
+      }
+
+      if (out.size() + encoded_size(cp, out) > maxUnits) {
+        out.resize(boundaryOut);
+        return boundaryIn;
+      }
+      encode_code_point(cp, out);
+
+      pictographicZwj = type == GraphemeBreak::ZWJ && pictographic;
+      pictographic = type == GraphemeBreak::Pictographic ||
+                     (pictographic && type == GraphemeBreak::Extend);
+      regionalIndicators =
+          type == GraphemeBreak::RegionalIndicator ? regionalIndicators + 1 : 0;
+      prev = type;
+      in += length;
+    }
+    return in;
+  }
+
+  // Applies the UAX #29 extended grapheme cluster rules (GB3-GB13) to decide
+  // whether a cluster boundary falls between prev and cur.
+  static bool is_grapheme_boundary(GraphemeBreak prev,
+                                   GraphemeBreak cur,
+                                   bool pictographicZwj,
+                                   size_t regionalIndicators) {
+    using B = GraphemeBreak;
+    if (prev == B::CR && cur == B::LF) {
+      return false;
+    }
+    if (prev == B::CR || prev == B::LF || prev == B::Control) {
+      return true;
+    }
+    if (cur == B::CR || cur == B::LF || cur == B::Control) {
+      return true;
+    }
+    if (prev == B::L &&
+        (cur == B::L || cur == B::V || cur == B::LV || cur == B::LVT)) {
+      return false;
+    }
+    if ((prev == B::LV || prev == B::V) && (cur == B::V || cur == B::T)) {
+      return false;
+    }
+    if ((prev == B::LVT || prev == B::T) && cur == B::T) {
+      return false;
+    }
+    if (cur == B::Extend || cur == B::ZWJ || cur == B::SpacingMark) {
+      return false;
+    }
+    if (prev == B::Prepend) {
+      return false;
+    }
+    if (pictographicZwj && cur == B::Pictographic) {
+      return false;
+    }
+    if (cur == B::RegionalIndicator && regionalIndicators % 2 == 1) {
+      return false;
+    }
+    return true;
+  }
+
+  // Looks up the Grapheme_Cluster_Break property of cp. Extended_Pictographic
+  // is folded in as its own class. Generated from Unicode 14.0.
+  static GraphemeBreak grapheme_break(char32_t cp) {
+    using B = GraphemeBreak;
+    if (cp >= 0xAC00 && cp <= 0xD7A3) {
+      return (cp - 0xAC00) % 28 == 0 ? B::LV : B::LVT;
+    }
+
+    struct Range {
+      char32_t first;
+      char32_t last;
+      GraphemeBreak type;
+    };
+    static const Range ranges[] = {
+      {0x0000, 0x0009, B::Control}, {0x000A, 0x000A, B::LF},
+      {0x000B, 0x000C, B::Control}, {0x000D, 0x000D, B::CR},
+      {0x000E, 0x001F, B::Control}, {0x007F, 0x009F, B::Control},
+      {0x00A9, 0x00A9, B::Pictographic}, {0x00AD, 0x00AD, B::Control},
+      {0x00AE, 0x00AE, B::Pictographic}, {0x0300, 0x036F, B::Extend},
+      {0x0483, 0x0489, B::Extend}, {0x0591, 0x05BD, B::Extend},
+      {0x05BF, 0x05BF, B::Extend}, {0x05C1, 0x05C2, B::Extend},
+      {0x05C4, 0x05C5, B::Extend}, {0x05C7, 0x05C7, B::Extend},
+      {0x0600, 0x0605, B::Prepend}, {0x0610, 0x061A, B::Extend},
+      {0x061C, 0x061C, B::Control}, {0x064B, 0x065F, B::Extend},
+      {0x0670, 0x0670, B::Extend}, {0x06D6, 0x06DC, B::Extend},
+      {0x06DD, 0x06DD, B::Prepend}, {0x06DF, 0x06E4, B::Extend},
+      {0x06E7, 0x06E8, B::Extend}, {0x06EA, 0x06ED, B::Extend},
+      {0x070F, 0x070F, B::Prepend}, {0x0711, 0x0711, B::Extend},
+      {0x0730, 0x074A, B::Extend}, {0x07A6, 0x07B0, B::Extend},
+      {0x07EB, 0x07F3, B::Extend}, {0x07FD, 0x07FD, B::Extend},
+      {0x0816, 0x0819, B::Extend}, {0x081B, 0x0823, B::Extend},
+      {0x0825, 0x0827, B::Extend}, {0x0829, 0x082D, B::Extend},
+      {0x0859, 0x085B, B::Extend}, {0x0890, 0x0891, B::Prepend},
+      {0x0898, 0x089F, B::Extend}, {0x08CA, 0x08E1, B::Extend},
+      {0x08E2, 0x08E2, B::Prepend}, {0x08E3, 0x0902, B::Extend},
+      {0x0903, 0x0903, B::SpacingMark}, {0x093A, 0x093A, B::Extend},
+      {0x093B, 0x093B, B::SpacingMark}, {0x093C, 0x093C, B::Extend},
+      {0x093E, 0x0940, B::SpacingMark}, {0x0941, 0x0948, B::Extend},
+      {0x0949, 0x094C, B::SpacingMark}, {0x094D, 0x094D, B::Extend},
+      {0x094E, 0x094F, B::SpacingMark}, {0x0951, 0x0957, B::Extend},
+      {0x0962, 0x0963, B::Extend}, {0x0981, 0x0981, B::Extend},
+      {0x0982, 0x0983, B::SpacingMark}, {0x09BC, 0x09BC, B::Extend},
+      {0x09BE, 0x09BE, B::Extend}, {0x09BF, 0x09C0, B::SpacingMark},
+      {0x09C1, 0x09C4, B::Extend}, {0x09C7, 0x09C8, B::SpacingMark},
+      {0x09CB, 0x09CC, B::SpacingMark}, {0x09CD, 0x09CD, B::Extend},
+      {0x09D7, 0x09D7, B::Extend}, {0x09E2, 0x09E3, B::Extend},
+      {0x09FE, 0x09FE, B::Extend}, {0x0A01, 0x0A02, B::Extend},
+      {0x0A03, 0x0A03, B::SpacingMark}, {0x0A3C, 0x0A3C, B::Extend},
+      {0x0A3E, 0x0A40, B::SpacingMark}, {0x0A41, 0x0A42, B::Extend},
+      {0x0A47, 0x0A48, B::Extend}, {0x0A4B, 0x0A4D, B::Extend},
+      {0x0A51, 0x0A51, B::Extend}, {0x0A70, 0x0A71, B::Extend},
+      {0x0A75, 0x0A75, B::Extend}, {0x0A81, 0x0A82, B::Extend},
+      {0x0A83, 0x0A83, B::SpacingMark}, {0x0ABC, 0x0ABC, B::Extend},
+      {0x0ABE, 0x0AC0, B::SpacingMark}, {0x0AC1, 0x0AC5, B::Extend},
+      {0x0AC7, 0x0AC8, B::Extend}, {0x0AC9, 0x0AC9, B::SpacingMark},
+      {0x0ACB, 0x0ACC, B::SpacingMark}, {0x0ACD, 0x0ACD, B::Extend},
+      {0x0AE2, 0x0AE3, B::Extend}, {0x0AFA, 0x0AFF, B::Extend},
+      {0x0B01, 0x0B01, B::Extend}, {0x0B02, 0x0B03, B::SpacingMark},
+      {0x0B3C, 0x0B3C, B::Extend}, {0x0B3E, 0x0B3F, B::Extend},
+      {0x0B40, 0x0B40, B::SpacingMark}, {0x0B41, 0x0B44, B::Extend},
+      {0x0B47, 0x0B48, B::SpacingMark}, {0x0B4B, 0x0B4C, B::SpacingMark},
+      {0x0B4D, 0x0B4D, B::Extend}, {0x0B55, 0x0B57, B::Extend},
+      {0x0B62, 0x0B63, B::Extend}, {0x0B82, 0x0B82, B::Extend},
+      {0x0BBE, 0x0BBE, B::Extend}, {0x0BBF, 0x0BBF, B::SpacingMark},
+      {0x0BC0, 0x0BC0, B::Extend}, {0x0BC1, 0x0BC2, B::SpacingMark},
+      {0x0BC6, 0x0BC8, B::SpacingMark}, {0x0BCA, 0x0BCC, B::SpacingMark},
+      {0x0BCD, 0x0BCD, B::Extend}, {0x0BD7, 0x0BD7, B::Extend},
+      {0x0C00, 0x0C00, B::Extend}, {0x0C01, 0x0C03, B::SpacingMark},
+      {0x0C04, 0x0C04, B::Extend}, {0x0C3C, 0x0C3C, B::Extend},
+      {0x0C3E, 0x0C40, B::Extend}, {0x0C41, 0x0C44, B::SpacingMark},
+      {0x0C46, 0x0C48, B::Extend}, {0x0C4A, 0x0C4D, B::Extend},
+      {0x0C55, 0x0C56, B::Extend}, {0x0C62, 0x0C63, B::Extend},
+      {0x0C81, 0x0C81, B::Extend}, {0x0C82, 0x0C83, B::SpacingMark},
+      {0x0CBC, 0x0CBC, B::Extend}, {0x0CBE, 0x0CBE, B::SpacingMark},
+      {0x0CBF, 0x0CBF, B::Extend}, {0x0CC0, 0x0CC1, B::SpacingMark},
+      {0x0CC2, 0x0CC2, B::Extend}, {0x0CC3, 0x0CC4, B::SpacingMark},
+      {0x0CC6, 0x0CC6, B::Extend}, {0x0CC7, 0x0CC8, B::SpacingMark},
+      {0x0CCA, 0x0CCB, B::SpacingMark}, {0x0CCC, 0x0CCD, B::Extend},
+      {0x0CD5, 0x0CD6, B::Extend}, {0x0CE2, 0x0CE3, B::Extend},
+      {0x0D00, 0x0D01, B::Extend}, {0x0D02, 0x0D03, B::SpacingMark},
+      {0x0D3B, 0x0D3C, B::Extend}, {0x0D3E, 0x0D3E, B::Extend},
+      {0x0D3F, 0x0D40, B::SpacingMark}, {0x0D41, 0x0D44, B::Extend},
+      {0x0D46, 0x0D48, B::SpacingMark}, {0x0D4A, 0x0D4C, B::SpacingMark},
+      {0x0D4D, 0x0D4D, B::Extend}, {0x0D4E, 0x0D4E, B::Prepend},
+      {0x0D57, 0x0D57, B::Extend}, {0x0D62, 0x0D63, B::Extend},
+      {0x0D81, 0x0D81, B::Extend}, {0x0D82, 0x0D83, B::SpacingMark},
+      {0x0DCA, 0x0DCA, B::Extend}, {0x0DCF, 0x0DCF, B::Extend},
+      {0x0DD0, 0x0DD1, B::SpacingMark}, {0x0DD2, 0x0DD4, B::Extend},
+      {0x0DD6, 0x0DD6, B::Extend}, {0x0DD8, 0x0DDE, B::SpacingMark},
+      {0x0DDF, 0x0DDF, B::Extend}, {0x0DF2, 0x0DF3, B::SpacingMark},
+      {0x0E31, 0x0E31, B::Extend}, {0x0E33, 0x0E33, B::SpacingMark},
+      {0x0E34, 0x0E3A, B::Extend}, {0x0E47, 0x0E4E, B::Extend},
+      {0x0EB1, 0x0EB1, B::Extend}, {0x0EB3, 0x0EB3, B::SpacingMark},
+      {0x0EB4, 0x0EBC, B::Extend}, {0x0EC8, 0x0ECD, B::Extend},
+      {0x0F18, 0x0F19, B::Extend}, {0x0F35, 0x0F35, B::Extend},
+      {0x0F37, 0x0F37, B::Extend}, {0x0F39, 0x0F39, B::Extend},
+      {0x0F3E, 0x0F3F, B::SpacingMark}, {0x0F71, 0x0F7E, B::Extend},
+      {0x0F7F, 0x0F7F, B::SpacingMark}, {0x0F80, 0x0F84, B::Extend},
+      {0x0F86, 0x0F87, B::Extend}, {0x0F8D, 0x0F97, B::Extend},
+      {0x0F99, 0x0FBC, B::Extend}, {0x0FC6, 0x0FC6, B::Extend},
+      {0x102D, 0x1030, B::Extend}, {0x1031, 0x1031, B::SpacingMark},
+      {0x1032, 0x1037, B::Extend}, {0x1039, 0x103A, B::Extend},
+      {0x103B, 0x103C, B::SpacingMark}, {0x103D, 0x103E, B::Extend},
+      {0x1056, 0x1057, B::SpacingMark}, {0x1058, 0x1059, B::Extend},
+      {0x105E, 0x1060, B::Extend}, {0x1071, 0x1074, B::Extend},
+      {0x1082, 0x1082, B::Extend}, {0x1084, 0x1084, B::SpacingMark},
+      {0x1085, 0x1086, B::Extend}, {0x108D, 0x108D, B::Extend},
+      {0x109D, 0x109D, B::Extend}, {0x1100, 0x115F, B::L},
+      {0x1160, 0x11A7, B::V}, {0x11A8, 0x11FF, B::T},
+      {0x135D, 0x135F, B::Extend}, {0x1712, 0x1714, B::Extend},
+      {0x1715, 0x1715, B::SpacingMark}, {0x1732, 0x1733, B::Extend},
+      {0x1734, 0x1734, B::SpacingMark}, {0x1752, 0x1753, B::Extend},
+      {0x1772, 0x1773, B::Extend}, {0x17B4, 0x17B5, B::Extend},
+      {0x17B6, 0x17B6, B::SpacingMark}, {0x17B7, 0x17BD, B::Extend},
+      {0x17BE, 0x17C5, B::SpacingMark}, {0x17C6, 0x17C6, B::Extend},
+      {0x17C7, 0x17C8, B::SpacingMark}, {0x17C9, 0x17D3, B::Extend},
+      {0x17DD, 0x17DD, B::Extend}, {0x180B, 0x180D, B::Extend},
+      {0x180E, 0x180E, B::Control}, {0x180F, 0x180F, B::Extend},
+      {0x1885, 0x1886, B::Extend}, {0x18A9, 0x18A9, B::Extend},
+      {0x1920, 0x1922, B::Extend}, {0x1923, 0x1926, B::SpacingMark},
+      {0x1927, 0x1928, B::Extend}, {0x1929, 0x192B, B::SpacingMark},
+      {0x1930, 0x1931, B::SpacingMark}, {0x1932, 0x1932, B::Extend},
+      {0x1933, 0x1938, B::SpacingMark}, {0x1939, 0x193B, B::Extend},
+      {0x1A17, 0x1A18, B::Extend}, {0x1A19, 0x1A1A, B::SpacingMark},
+      {0x1A1B, 0x1A1B, B::Extend}, {0x1A55, 0x1A55, B::SpacingMark},
+      {0x1A56, 0x1A56, B::Extend}, {0x1A57, 0x1A57, B::SpacingMark},
+      {0x1A58, 0x1A5E, B::Extend}, {0x1A60, 0x1A60, B::Extend},
+      {0x1A62, 0x1A62, B::Extend}, {0x1A65, 0x1A6C, B::Extend},
+      {0x1A6D, 0x1A72, B::SpacingMark}, {0x1A73, 0x1A7C, B::Extend},
+      {0x1A7F, 0x1A7F, B::Extend}, {0x1AB0, 0x1ACE, B::Extend},
+      {0x1B00, 0x1B03, B::Extend}, {0x1B04, 0x1B04, B::SpacingMark},
+      {0x1B34, 0x1B3A, B::Extend}, {0x1B3B, 0x1B3B, B::SpacingMark},
+      {0x1B3C, 0x1B3C, B::Extend}, {0x1B3D, 0x1B41, B::SpacingMark},
+      {0x1B42, 0x1B42, B::Extend}, {0x1B43, 0x1B44, B::SpacingMark},
+      {0x1B6B, 0x1B73, B::Extend}, {0x1B80, 0x1B81, B::Extend},
+      {0x1B82, 0x1B82, B::SpacingMark}, {0x1BA1, 0x1BA1, B::SpacingMark},
+      {0x1BA2, 0x1BA5, B::Extend}, {0x1BA6, 0x1BA7, B::SpacingMark},
+      {0x1BA8, 0x1BA9, B::Extend}, {0x1BAA, 0x1BAA, B::SpacingMark},
+      {0x1BAB, 0x1BAD, B::Extend}, {0x1BE6, 0x1BE6, B::Extend},
+      {0x1BE7, 0x1BE7, B::SpacingMark}, {0x1BE8, 0x1BE9, B::Extend},
+      {0x1BEA, 0x1BEC, B::SpacingMark}, {0x1BED, 0x1BED, B::Extend},
+      {0x1BEE, 0x1BEE, B::SpacingMark}, {0x1BEF, 0x1BF1, B::Extend},
+      {0x1BF2, 0x1BF3, B::SpacingMark}, {0x1C24, 0x1C2B, B::SpacingMark},
+      {0x1C2C, 0x1C33, B::Extend}, {0x1C34, 0x1C35, B::SpacingMark},
+      {0x1C36, 0x1C37, B::Extend}, {0x1CD0, 0x1CD2, B::Extend},
+      {0x1CD4, 0x1CE0, B::Extend}, {0x1CE1, 0x1CE1, B::SpacingMark},
+      {0x1CE2, 0x1CE8, B::Extend}, {0x1CED, 0x1CED, B::Extend},
+      {0x1CF4, 0x1CF4, B::Extend}, {0x1CF7, 0x1CF7, B::SpacingMark},
+      {0x1CF8, 0x1CF9, B::Extend}, {0x1DC0, 0x1DFF, B::Extend},
+      {0x200B, 0x200B, B::Control}, {0x200C, 0x200C, B::Extend},
+      {0x200D, 0x200D, B::ZWJ}, {0x200E, 0x200F, B::Control},
+      {0x2028, 0x202E, B::Control}, {0x203C, 0x203C, B::Pictographic},
+      {0x2049, 0x2049, B::Pictographic}, {0x2060, 0x206F, B::Control},
+      {0x20D0, 0x20F0, B::Extend}, {0x2122, 0x2122, B::Pictographic},
+      {0x2139, 0x2139, B::Pictographic}, {0x2194, 0x2199, B::Pictographic},
+      {0x21A9, 0x21AA, B::Pictographic}, {0x231A, 0x231B, B::Pictographic},
+      {0x2328, 0x2328, B::Pictographic}, {0x2388, 0x2388, B::Pictographic},
+      {0x23CF, 0x23CF, B::Pictographic}, {0x23E9, 0x23F3, B::Pictographic},
+      {0x23F8, 0x23FA, B::Pictographic}, {0x24C2, 0x24C2, B::Pictographic},
+      {0x25AA, 0x25AB, B::Pictographic}, {0x25B6, 0x25B6, B::Pictographic},
+      {0x25C0, 0x25C0, B::Pictographic}, {0x25FB, 0x25FE, B::Pictographic},
+      {0x2600, 0x2605, B::Pictographic}, {0x2607, 0x2612, B::Pictographic},
+      {0x2614, 0x2685, B::Pictographic}, {0x2690, 0x2705, B::Pictographic},
+      {0x2708, 0x2712, B::Pictographic}, {0x2714, 0x2714, B::Pictographic},
+      {0x2716, 0x2716, B::Pictographic}, {0x271D, 0x271D, B::Pictographic},
+      {0x2721, 0x2721, B::Pictographic}, {0x2728, 0x2728, B::Pictographic},
+      {0x2733, 0x2734, B::Pictographic}, {0x2744, 0x2744, B::Pictographic},
+      {0x2747, 0x2747, B::Pictographic}, {0x274C, 0x274C, B::Pictographic},
+      {0x274E, 0x274E, B::Pictographic}, {0x2753, 0x2755, B::Pictographic},
+      {0x2757, 0x2757, B::Pictographic}, {0x2763, 0x2767, B::Pictographic},
+      {0x2795, 0x2797, B::Pictographic}, {0x27A1, 0x27A1, B::Pictographic},
+      {0x27B0, 0x27B0, B::Pictographic}, {0x27BF, 0x27BF, B::Pictographic},
+      {0x2934, 0x2935, B::Pictographic}, {0x2B05, 0x2B07, B::Pictographic},
+      {0x2B1B, 0x2B1C, B::Pictographic}, {0x2B50, 0x2B50, B::Pictographic},
+      {0x2B55, 0x2B55, B::Pictographic}, {0x2CEF, 0x2CF1, B::Extend},
+      {0x2D7F, 0x2D7F, B::Extend}, {0x2DE0, 0x2DFF, B::Extend},
+      {0x302A, 0x302F, B::Extend}, {0x3030, 0x3030, B::Pictographic},
+      {0x303D, 0x303D, B::Pictographic}, {0x3099, 0x309A, B::Extend},
+      {0x3297, 0x3297, B::Pictographic}, {0x3299, 0x3299, B::Pictographic},
+      {0xA66F, 0xA672, B::Extend}, {0xA674, 0xA67D, B::Extend},
+      {0xA69E, 0xA69F, B::Extend}, {0xA6F0, 0xA6F1, B::Extend},
+      {0xA802, 0xA802, B::Extend}, {0xA806, 0xA806, B::Extend},
+      {0xA80B, 0xA80B, B::Extend}, {0xA823, 0xA824, B::SpacingMark},
+      {0xA825, 0xA826, B::Extend}, {0xA827, 0xA827, B::SpacingMark},
+      {0xA82C, 0xA82C, B::Extend}, {0xA880, 0xA881, B::SpacingMark},
+      {0xA8B4, 0xA8C3, B::SpacingMark}, {0xA8C4, 0xA8C5, B::Extend},
+      {0xA8E0, 0xA8F1, B::Extend}, {0xA8FF, 0xA8FF, B::Extend},
+      {0xA926, 0xA92D, B::Extend}, {0xA947, 0xA951, B::Extend},
+      {0xA952, 0xA953, B::SpacingMark}, {0xA960, 0xA97C, B::L},
+      {0xA980, 0xA982, B::Extend}, {0xA983, 0xA983, B::SpacingMark},
+      {0xA9B3, 0xA9B3, B::Extend}, {0xA9B4, 0xA9B5, B::SpacingMark},
+      {0xA9B6, 0xA9B9, B::Extend}, {0xA9BA, 0xA9BB, B::SpacingMark},
+      {0xA9BC, 0xA9BD, B::Extend}, {0xA9BE, 0xA9C0, B::SpacingMark},
+      {0xA9E5, 0xA9E5, B::Extend}, {0xAA29, 0xAA2E, B::Extend},
+      {0xAA2F, 0xAA30, B::SpacingMark}, {0xAA31, 0xAA32, B::Extend},
+      {0xAA33, 0xAA34, B::SpacingMark}, {0xAA35, 0xAA36, B::Extend},
+      {0xAA43, 0xAA43, B::Extend}, {0xAA4C, 0xAA4C, B::Extend},
+      {0xAA4D, 0xAA4D, B::SpacingMark}, {0xAA7C, 0xAA7C, B::Extend},
+      {0xAAB0, 0xAAB0, B::Extend}, {0xAAB2, 0xAAB4, B::Extend},
+      {0xAAB7, 0xAAB8, B::Extend}, {0xAABE, 0xAABF, B::Extend},
+      {0xAAC1, 0xAAC1, B::Extend}, {0xAAEB, 0xAAEB, B::SpacingMark},
+      {0xAAEC, 0xAAED, B::Extend}, {0xAAEE, 0xAAEF, B::SpacingMark},
+      {0xAAF5, 0xAAF5, B::SpacingMark}, {0xAAF6, 0xAAF6, B::Extend},
+      {0xABE3, 0xABE4, B::SpacingMark}, {0xABE5, 0xABE5, B::Extend},
+      {0xABE6, 0xABE7, B::SpacingMark}, {0xABE8, 0xABE8, B::Extend},
+      {0xABE9, 0xABEA, B::SpacingMark}, {0xABEC, 0xABEC, B::SpacingMark},
+      {0xABED, 0xABED, B::Extend}, {0xD7B0, 0xD7C6, B::V},
+      {0xD7CB, 0xD7FB, B::T}, {0xFB1E, 0xFB1E, B::Extend},
+      {0xFE00, 0xFE0F, B::Extend}, {0xFE20, 0xFE2F, B::Extend},
+      {0xFEFF, 0xFEFF, B::Control}, {0xFF9E, 0xFF9F, B::Extend},
+      {0xFFF0, 0xFFFB, B::Control}, {0x101FD, 0x101FD, B::Extend},
+      {0x102E0, 0x102E0, B::Extend}, {0x10376, 0x1037A, B::Extend},
+      {0x10A01, 0x10A03, B::Extend}, {0x10A05, 0x10A06, B::Extend},
+      {0x10A0C, 0x10A0F, B::Extend}, {0x10A38, 0x10A3A, B::Extend},
+      {0x10A3F, 0x10A3F, B::Extend}, {0x10AE5, 0x10AE6, B::Extend},
+      {0x10D24, 0x10D27, B::Extend}, {0x10EAB, 0x10EAC, B::Extend},
+      {0x10F46, 0x10F50, B::Extend}, {0x10F82, 0x10F85, B::Extend},
+      {0x11000, 0x11000, B::SpacingMark}, {0x11001, 0x11001, B::Extend},
+      {0x11002, 0x11002, B::SpacingMark}, {0x11038, 0x11046, B::Extend},
+      {0x11070, 0x11070, B::Extend}, {0x11073, 0x11074, B::Extend},
+      {0x1107F, 0x11081, B::Extend}, {0x11082, 0x11082, B::SpacingMark},
+      {0x110B0, 0x110B2, B::SpacingMark}, {0x110B3, 0x110B6, B::Extend},
+      {0x110B7, 0x110B8, B::SpacingMark}, {0x110B9, 0x110BA, B::Extend},
+      {0x110BD, 0x110BD, B::Prepend}, {0x110C2, 0x110C2, B::Extend},
+      {0x110CD, 0x110CD, B::Prepend}, {0x11100, 0x11102, B::Extend},
+      {0x11127, 0x1112B, B::Extend}, {0x1112C, 0x1112C, B::SpacingMark},
+      {0x1112D, 0x11134, B::Extend}, {0x11145, 0x11146, B::SpacingMark},
+      {0x11173, 0x11173, B::Extend}, {0x11180, 0x11181, B::Extend},
+      {0x11182, 0x11182, B::SpacingMark}, {0x111B3, 0x111B5, B::SpacingMark},
+      {0x111B6, 0x111BE, B::Extend}, {0x111BF, 0x111C0, B::SpacingMark},
+      {0x111C2, 0x111C3, B::Prepend}, {0x111C9, 0x111CC, B::Extend},
+      {0x111CE, 0x111CE, B::SpacingMark}, {0x111CF, 0x111CF, B::Extend},
+      {0x1122C, 0x1122E, B::SpacingMark}, {0x1122F, 0x11231, B::Extend},
+      {0x11232, 0x11233, B::SpacingMark}, {0x11234, 0x11234, B::Extend},
+      {0x11235, 0x11235, B::SpacingMark}, {0x11236, 0x11237, B::Extend},
+      {0x1123E, 0x1123E, B::Extend}, {0x112DF, 0x112DF, B::Extend},
+      {0x112E0, 0x112E2, B::SpacingMark}, {0x112E3, 0x112EA, B::Extend},
+      {0x11300, 0x11301, B::Extend}, {0x11302, 0x11303, B::SpacingMark},
+      {0x1133B, 0x1133C, B::Extend}, {0x1133E, 0x1133E, B::Extend},
+      {0x1133F, 0x1133F, B::SpacingMark}, {0x11340, 0x11340, B::Extend},
+      {0x11341, 0x11344, B::SpacingMark}, {0x11347, 0x11348, B::SpacingMark},
+      {0x1134B, 0x1134D, B::SpacingMark}, {0x11357, 0x11357, B::Extend},
+      {0x11362, 0x11363, B::SpacingMark}, {0x11366, 0x1136C, B::Extend},
+      {0x11370, 0x11374, B::Extend}, {0x11435, 0x11437, B::SpacingMark},
+      {0x11438, 0x1143F, B::Extend}, {0x11440, 0x11441, B::SpacingMark},
+      {0x11442, 0x11444, B::Extend}, {0x11445, 0x11445, B::SpacingMark},
+      {0x11446, 0x11446, B::Extend}, {0x1145E, 0x1145E, B::Extend},
+      {0x114B0, 0x114B0, B::Extend}, {0x114B1, 0x114B2, B::SpacingMark},
+      {0x114B3, 0x114B8, B::Extend}, {0x114B9, 0x114B9, B::SpacingMark},
+      {0x114BA, 0x114BA, B::Extend}, {0x114BB, 0x114BC, B::SpacingMark},
+      {0x114BD, 0x114BD, B::Extend}, {0x114BE, 0x114BE, B::SpacingMark},
+      {0x114BF, 0x114C0, B::Extend}, {0x114C1, 0x114C1, B::SpacingMark},
+      {0x114C2, 0x114C3, B::Extend}, {0x115AF, 0x115AF, B::Extend},
+      {0x115B0, 0x115B1, B::SpacingMark}, {0x115B2, 0x115B5, B::Extend},
+      {0x115B8, 0x115BB, B::SpacingMark}, {0x115BC, 0x115BD, B::Extend},
+      {0x115BE, 0x115BE, B::SpacingMark}, {0x115BF, 0x115C0, B::Extend},
+      {0x115DC, 0x115DD, B::Extend}, {0x11630, 0x11632, B::SpacingMark},
+      {0x11633, 0x1163A, B::Extend}, {0x1163B, 0x1163C, B::SpacingMark},
+      {0x1163D, 0x1163D, B::Extend}, {0x1163E, 0x1163E, B::SpacingMark},
+      {0x1163F, 0x11640, B::Extend}, {0x116AB, 0x116AB, B::Extend},
+      {0x116AC, 0x116AC, B::SpacingMark}, {0x116AD, 0x116AD, B::Extend},
+      {0x116AE, 0x116AF, B::SpacingMark}, {0x116B0, 0x116B5, B::Extend},
+      {0x116B6, 0x116B6, B::SpacingMark}, {0x116B7, 0x116B7, B::Extend},
+      {0x1171D, 0x1171F, B::Extend}, {0x11722, 0x11725, B::Extend},
+      {0x11726, 0x11726, B::SpacingMark}, {0x11727, 0x1172B, B::Extend},
+      {0x1182C, 0x1182E, B::SpacingMark}, {0x1182F, 0x11837, B::Extend},
+      {0x11838, 0x11838, B::SpacingMark}, {0x11839, 0x1183A, B::Extend},
+      {0x11930, 0x11930, B::Extend}, {0x11931, 0x11935, B::SpacingMark},
+      {0x11937, 0x11938, B::SpacingMark}, {0x1193B, 0x1193C, B::Extend},
+      {0x1193D, 0x1193D, B::SpacingMark}, {0x1193E, 0x1193E, B::Extend},
+      {0x1193F, 0x1193F, B::Prepend}, {0x11940, 0x11940, B::SpacingMark},
+      {0x11941, 0x11941, B::Prepend}, {0x11942, 0x11942, B::SpacingMark},
+      {0x11943, 0x11943, B::Extend}, {0x119D1, 0x119D3, B::SpacingMark},
+      {0x119D4, 0x119D7, B::Extend}, {0x119DA, 0x119DB, B::Extend},
+      {0x119DC, 0x119DF, B::SpacingMark}, {0x119E0, 0x119E0, B::Extend},
+      {0x119E4, 0x119E4, B::SpacingMark}, {0x11A01, 0x11A0A, B::Extend},
+      {0x11A33, 0x11A38, B::Extend}, {0x11A39, 0x11A39, B::SpacingMark},
+      {0x11A3A, 0x11A3A, B::Prepend}, {0x11A3B, 0x11A3E, B::Extend},
+      {0x11A47, 0x11A47, B::Extend}, {0x11A51, 0x11A56, B::Extend},
+      {0x11A57, 0x11A58, B::SpacingMark}, {0x11A59, 0x11A5B, B::Extend},
+      {0x11A84, 0x11A89, B::Prepend}, {0x11A8A, 0x11A96, B::Extend},
+      {0x11A97, 0x11A97, B::SpacingMark}, {0x11A98, 0x11A99, B::Extend},
+      {0x11C2F, 0x11C2F, B::SpacingMark}, {0x11C30, 0x11C36, B::Extend},
+      {0x11C38, 0x11C3D, B::Extend}, {0x11C3E, 0x11C3E, B::SpacingMark},
+      {0x11C3F, 0x11C3F, B::Extend}, {0x11C92, 0x11CA7, B::Extend},
+      {0x11CA9, 0x11CA9, B::SpacingMark}, {0x11CAA, 0x11CB0, B::Extend},
+      {0x11CB1, 0x11CB1, B::SpacingMark}, {0x11CB2, 0x11CB3, B::Extend},
+      {0x11CB4, 0x11CB4, B::SpacingMark}, {0x11CB5, 0x11CB6, B::Extend},
+      {0x11D31, 0x11D36, B::Extend}, {0x11D3A, 0x11D3A, B::Extend},
+      {0x11D3C, 0x11D3D, B::Extend}, {0x11D3F, 0x11D45, B::Extend},
+      {0x11D46, 0x11D46, B::Prepend}, {0x11D47, 0x11D47, B::Extend},
+      {0x11D8A, 0x11D8E, B::SpacingMark}, {0x11D90, 0x11D91, B::Extend},
+      {0x11D93, 0x11D94, B::SpacingMark}, {0x11D95, 0x11D95, B::Extend},
+      {0x11D96, 0x11D96, B::SpacingMark}, {0x11D97, 0x11D97, B::Extend},
+      {0x11EF3, 0x11EF4, B::Extend}, {0x11EF5, 0x11EF6, B::SpacingMark},
+      {0x13430, 0x13438, B::Control}, {0x16AF0, 0x16AF4, B::Extend},
+      {0x16B30, 0x16B36, B::Extend}, {0x16F4F, 0x16F4F, B::Extend},
+      {0x16F51, 0x16F87, B::SpacingMark}, {0x16F8F, 0x16F92, B::Extend},
+      {0x16FE4, 0x16FE4, B::Extend}, {0x16FF0, 0x16FF1, B::SpacingMark},
+      {0x1BC9D, 0x1BC9E, B::Extend}, {0x1BCA0, 0x1BCA3, B::Control},
+      {0x1CF00, 0x1CF2D, B::Extend}, {0x1CF30, 0x1CF46, B::Extend},
+      {0x1D165, 0x1D165, B::Extend}, {0x1D166, 0x1D166, B::SpacingMark},
+      {0x1D167, 0x1D169, B::Extend}, {0x1D16D, 0x1D16D, B::SpacingMark},
+      {0x1D16E, 0x1D172, B::Extend}, {0x1D173, 0x1D17A, B::Control},
+      {0x1D17B, 0x1D182, B::Extend}, {0x1D185, 0x1D18B, B::Extend},
+      {0x1D1AA, 0x1D1AD, B::Extend}, {0x1D242, 0x1D244, B::Extend},
+      {0x1DA00, 0x1DA36, B::Extend}, {0x1DA3B, 0x1DA6C, B::Extend},
+      {0x1DA75, 0x1DA75, B::Extend}, {0x1DA84, 0x1DA84, B::Extend},
+      {0x1DA9B, 0x1DA9F, B::Extend}, {0x1DAA1, 0x1DAAF, B::Extend},
+      {0x1E000, 0x1E006, B::Extend}, {0x1E008, 0x1E018, B::Extend},
+      {0x1E01B, 0x1E021, B::Extend}, {0x1E023, 0x1E024, B::Extend},
+      {0x1E026, 0x1E02A, B::Extend}, {0x1E130, 0x1E136, B::Extend},
+      {0x1E2AE, 0x1E2AE, B::Extend}, {0x1E2EC, 0x1E2EF, B::Extend},
+      {0x1E8D0, 0x1E8D6, B::Extend}, {0x1E944, 0x1E94A, B::Extend},
+      {0x1F000, 0x1F0FF, B::Pictographic}, {0x1F10D, 0x1F10F, B::Pictographic},
+      {0x1F12F, 0x1F12F, B::Pictographic}, {0x1F16C, 0x1F171, B::Pictographic},
+      {0x1F17E, 0x1F17F, B::Pictographic}, {0x1F18E, 0x1F18E, B::Pictographic},
+      {0x1F191, 0x1F19A, B::Pictographic}, {0x1F1AD, 0x1F1E5, B::Pictographic},
+      {0x1F1E6, 0x1F1FF, B::RegionalIndicator},
+      {0x1F201, 0x1F20F, B::Pictographic}, {0x1F21A, 0x1F21A, B::Pictographic},
+      {0x1F22F, 0x1F22F, B::Pictographic}, {0x1F232, 0x1F23A, B::Pictographic},
+      {0x1F23C, 0x1F23F, B::Pictographic}, {0x1F249, 0x1F3FA, B::Pictographic},
+      {0x1F3FB, 0x1F3FF, B::Extend}, {0x1F400, 0x1F53D, B::Pictographic},
+      {0x1F546, 0x1F64F, B::Pictographic}, {0x1F680, 0x1F6FF, B::Pictographic},
+      {0x1F774, 0x1F77F, B::Pictographic}, {0x1F7D5, 0x1F7FF, B::Pictographic},
+      {0x1F80C, 0x1F80F, B::Pictographic}, {0x1F848, 0x1F84F, B::Pictographic},
+      {0x1F85A, 0x1F85F, B::Pictographic}, {0x1F888, 0x1F88F, B::Pictographic},
+      {0x1F8AE, 0x1F8FF, B::Pictographic}, {0x1F90C, 0x1F93A, B::Pictographic},
+      {0x1F93C, 0x1F945, B::Pictographic}, {0x1F947, 0x1FAFF, B::Pictographic},
+      {0x1FC00, 0x1FFFD, B::Pictographic}, {0xE0000, 0xE001F, B::Control},
+      {0xE0020, 0xE007F, B::Extend}, {0xE0080, 0xE00FF, B::Control},
+      {0xE0100, 0xE01EF, B::Extend}, {0xE01F0, 0xE0FFF, B::Control},
+    };
+
+    size_t lo = 0;
+    size_t hi = sizeof(ranges) / sizeof(ranges[0]);
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (cp < ranges[mid].first) {
+        hi = mid;
+      } else if (cp > ranges[mid].last) {
+        lo = mid + 1;
+      } else {
+        return ranges[mid].type;
+      }
+    }
+    return B::Other;
+  }
+
+  static size_t decode_code_point(const std::string& str,
+                                  size_t i,
+                                  char32_t& cp) {
+    unsigned char byte = str[i];
+    size_t remainingBytes;
+    char32_t minimum;
+    if ((byte & 0x80) == 0) {
+      cp = byte;
+      return 1;
+    } else if ((byte & 0xE0) == 0xC0) {
+      cp = byte & 0x1F;
+      remainingBytes = 1;
+      minimum = 0x80;
+    } else if ((byte & 0xF0) == 0xE0) {
+      cp = byte & 0x0F;
+      remainingBytes = 2;
+      minimum = 0x800;
+    } else if ((byte & 0xF8) == 0xF0) {
+      cp = byte & 0x07;
+      remainingBytes = 3;
+      minimum = 0x10000;
+    } else {
+      throw std::invalid_argument("Invalid UTF-8 sequence: invalid start byte");
+    }
+
+    for (size_t j = 1; j <= remainingBytes; ++j) {
+      if (i + j >= str.size() || (str[i + j] & 0xC0) != 0x80) {
+        throw std::invalid_argument(
+            "Invalid UTF-8 sequence: missing continuation byte");
+      }
+      cp = (cp << 6) | (str[i + j] & 0x3F);
+    }
+    if (cp < minimum) {
+      throw std::invalid_argument("Invalid UTF-8 sequence: overlong encoding");
+    }
+    if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+      throw std::invalid_argument("Invalid UTF-8 sequence: invalid code point");
+    }
+    return remainingBytes + 1;
+  }
+
+  static size_t decode_code_point(const std::u16string& str,
+                                  size_t i,
+                                  char32_t& cp) {
+    char16_t c = str[i];
+    if (c >= 0xD800 && c <= 0xDBFF) {
+      if (i + 1 >= str.size() || str[i + 1] < 0xDC00 || str[i + 1] > 0xDFFF) {
+        throw std::invalid_argument(
+            "Invalid UTF-16 sequence: lone high surrogate");
+      }
+      cp = 0x10000 + ((c - 0xD800) << 10) + (str[i + 1] - 0xDC00);
+      return 2;
+    } else if (c >= 0xDC00 && c <= 0xDFFF) {
+      throw std::invalid_argument(
+          "Invalid UTF-16 sequence: lone low surrogate");
+    }
+    cp = c;
+    return 1;
+  }
+
+  static size_t decode_code_point(const std::u32string& str,
+                                  size_t i,
+                                  char32_t& cp) {
+    cp = str[i];
+    if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+      throw std::invalid_argument(
+          "The string contains invalid UTF-32 code points.");
+    }
+    return 1;
+  }
+
+  static size_t encoded_size(char32_t cp, const std::string&) {
+    return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+  }
+
+  static size_t encoded_size(char32_t cp, const std::u16string&) {
+    return cp < 0x10000 ? 1 : 2;
+  }
+
+  static void encode_code_point(char32_t cp, std::string& out) {
+    if (cp < 0x80) {
+      out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+
+  static void encode_code_point(char32_t cp, std::u16string& out) {
+    if (cp < 0x10000) {
+      out.push_back(static_cast<char16_t>(cp));
+    } else {
+      cp -= 0x10000;
+      out.push_back(static_cast<char16_t>(0xD800 + (cp >> 10)));
+      out.push_back(static_cast<char16_t>(0xDC00 + (cp & 0x3FF)));
+    }
+  }
 };
 
 }  // namespace bene
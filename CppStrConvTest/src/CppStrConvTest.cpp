@@ -4,6 +4,20 @@
 
 namespace bene {
 
+TEST(CppStrConvTest, iso_8859_1_bytes_to_u16_Success) {
+  // Given
+  std::vector<char> input = {'C', 'a', 'f', '\xe9', ' ', 'c', 'r', '\xe8',
+                             'm', 'e', ' ', 'b', 'r', '\xfb', 'l', '\xe9',
+                             'e', ' ', '\xa9'};
+  std::u16string expected = u"Caf\u00e9 cr\u00e8me br\u00fbl\u00e9e \u00a9";
+
+  // When
+  std::u16string result = CppStrConv::iso_8859_1_bytes_to_u16(input);
+
+  // Then
+  EXPECT_EQ(result, expected);
+}
+
 TEST(CppStrConvTest, u16_bytes_to_u16_Success) {
   // Given
   std::vector<char> input = {'\x00', '\x41', '\x30', '\x42', '\xD8',
@@ -26,6 +40,54 @@ TEST(CppStrConvTest, u16_bytes_to_u16_InvalidBOM) {
                std::invalid_argument);
 }
 
+TEST(CppStrConvTest, u16_to_iso_8859_1_bytes_Report) {
+  // Given
+  std::u16string input = u"Caf\u00e9 \u20ac 100, \U0001F600 and more text";
+
+  // When
+  ConversionReport report;
+  std::vector<char> bytes = CppStrConv::u16_to_iso_8859_1_bytes(input, report);
+  std::string result(bytes.begin(), bytes.end());
+
+  // Then
+  EXPECT_EQ(result, "Caf\xe9 ? 100, ? and more text");
+  EXPECT_EQ(report.unmappableCount, 2u);
+  EXPECT_EQ(report.firstUnmappable, 5u);
+}
+
+TEST(CppStrConvTest, u16_to_iso_8859_1_bytes_LongRuns) {
+  // Given
+  std::u16string input = std::u16string(16, u'\u00e9') +
+                         std::u16string(7, u'\u00fc') + u'\u20ac' +
+                         std::u16string(24, u'\u00ff');
+  std::string expected = std::string(16, '\xe9') + std::string(7, '\xfc') +
+                         '*' + std::string(24, '\xff');
+
+  // When
+  ConversionReport report;
+  std::vector<char> bytes = CppStrConv::u16_to_iso_8859_1_bytes(
+      input, report, UnmappablePolicy::Replace, '*');
+  std::string result(bytes.begin(), bytes.end());
+
+  // Then
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(report.unmappableCount, 1u);
+  EXPECT_EQ(report.firstUnmappable, 23u);
+}
+
+TEST(CppStrConvTest, u16_to_iso_8859_1_bytes_ReportReused) {
+  // Given
+  ConversionReport report;
+  CppStrConv::u16_to_iso_8859_1_bytes(u"\u20ac", report);
+
+  // When
+  CppStrConv::u16_to_iso_8859_1_bytes(u"abc\u20ac", report);
+
+  // Then
+  EXPECT_EQ(report.unmappableCount, 1u);
+  EXPECT_EQ(report.firstUnmappable, 3u);
+}
+
 TEST(CppStrConvTest, u16_to_u8_EmptyString) {
   // Given
   std::u16string utf16_str = u"";
@@ -50,6 +112,102 @@ TEST(CppStrConvTest, u16_to_u8_InvalidU16) {
                std::invalid_argument);
 }
 
+TEST(CppStrConvTest, u16_to_u8_truncated_CodePointBoundary) {
+  // Given
+  std::u16string utf16_str = u"A\u3042\U0001F600";  // 'A', 'あ', '😀'
+  size_t consumed = 0;
+
+  // When
+  std::string cut = CppStrConv::u16_to_u8_truncated(utf16_str, 7, consumed);
+
+  // Then
+  EXPECT_EQ(cut, "A\xE3\x81\x82");
+  EXPECT_EQ(consumed, 2u);
+
+  // When
+  std::string whole = CppStrConv::u16_to_u8_truncated(utf16_str, 8, consumed);
+
+  // Then
+  EXPECT_EQ(whole, "A\xE3\x81\x82\xF0\x9F\x98\x80");
+  EXPECT_EQ(consumed, 4u);
+}
+
+TEST(CppStrConvTest, u16_to_u8_truncated_GraphemeBoundary) {
+  // Given
+  std::u16string utf16_str = u"e\u0301e\u0301";  // Decomposed 'é' twice
+  size_t consumed = 0;
+
+  // When
+  std::string by_code_point =
+      CppStrConv::u16_to_u8_truncated(utf16_str, 5, consumed);
+
+  // Then
+  EXPECT_EQ(by_code_point, "e\xCC\x81"
+            "e");
+  EXPECT_EQ(consumed, 3u);
+
+  // When
+  std::string by_grapheme =
+      CppStrConv::u16_to_u8_truncated(utf16_str, 5, consumed, true);
+
+  // Then
+  EXPECT_EQ(by_grapheme, "e\xCC\x81");
+  EXPECT_EQ(consumed, 2u);
+}
+
+TEST(CppStrConvTest, u16_to_u8_truncated_CombiningMarks) {
+  // Given
+  std::u16string arabic = u"\u0628\u0650\u0633";  // 'بِس'
+  std::u16string devanagari =
+      u"\u0928\u092E\u0938\u094D\u0924\u0947";  // 'नमस्ते'
+  size_t consumed = 0;
+
+  // When
+  std::string arabic_cut =
+      CppStrConv::u16_to_u8_truncated(arabic, 2, consumed, true);
+
+  // Then
+  EXPECT_EQ(arabic_cut, "");
+  EXPECT_EQ(consumed, 0u);
+
+  // When
+  std::string devanagari_cut =
+      CppStrConv::u16_to_u8_truncated(devanagari, 9, consumed, true);
+
+  // Then
+  EXPECT_EQ(devanagari_cut, "\xE0\xA4\xA8\xE0\xA4\xAE");  // 'नम'
+  EXPECT_EQ(consumed, 2u);
+}
+
+TEST(CppStrConvTest, u16_to_u8_truncated_CRLF) {
+  // Given
+  std::u16string utf16_str = u"a\r\n";
+  size_t consumed = 0;
+
+  // When
+  std::string result =
+      CppStrConv::u16_to_u8_truncated(utf16_str, 2, consumed, true);
+
+  // Then
+  EXPECT_EQ(result, "a");
+  EXPECT_EQ(consumed, 1u);
+}
+
+TEST(CppStrConvTest, u16_to_u8_truncated_EmojiSequence) {
+  // Given
+  std::u16string utf16_str =
+      u"A\U0001F469\u200D\U0001F4BBB";  // 'A', woman technologist, 'B'
+  size_t consumed = 0;
+
+  // When
+  std::string result =
+      CppStrConv::u16_to_u8_truncated(utf16_str, 10, consumed, true);
+
+  // Then
+  EXPECT_EQ(result, "A");
+  EXPECT_EQ(consumed, 1u);
+}
+
 TEST(CppStrConvTest, u16_to_u8_bytes_WithBOM) {
   // Given
   std::u16string utf16_str = u"Test BOM";
@@ -61,6 +219,20 @@ TEST(CppStrConvTest, u16_to_u8_bytes_WithBOM) {
   EXPECT_TRUE(CppStrConv::is_start_with_bom_u8(utf8_bytes));
 }
 
+TEST(CppStrConvTest, u16_to_u8_truncated_JoinerWithoutEmoji) {
+  // Given
+  std::u16string utf16_str = u"a\u200Db";
+  size_t consumed = 0;
+
+  // When
+  std::string result =
+      CppStrConv::u16_to_u8_truncated(utf16_str, 4, consumed, true);
+
+  // Then
+  EXPECT_EQ(result, "a\xE2\x80\x8D");
+  EXPECT_EQ(consumed, 2u);
+}
+
 TEST(CppStrConvTest, u16_to_us_ascii_bytes_Success) {
   // Given
   std::u16string ascii_str = u"ASCII Text";
@@ -85,6 +257,50 @@ TEST(CppStrConvTest, u16_to_us_ascii_bytes_Invalid) {
   EXPECT_EQ(result, "Hello, ?");
 }
 
+TEST(CppStrConvTest, u16_to_us_ascii_bytes_Lossless) {
+  // Given
+  std::u16string ascii_str = u"A long enough ASCII text to fill a vector";
+
+  // When
+  ConversionReport report;
+  std::vector<char> ascii_bytes =
+      CppStrConv::u16_to_us_ascii_bytes(ascii_str, report);
+
+  // Then
+  EXPECT_EQ(std::string(ascii_bytes.begin(), ascii_bytes.end()),
+            "A long enough ASCII text to fill a vector");
+  EXPECT_EQ(report.unmappableCount, 0u);
+  EXPECT_EQ(report.firstUnmappable, std::string::npos);
+}
+
+TEST(CppStrConvTest, u16_to_us_ascii_bytes_SkipPolicy) {
+  // Given
+  std::u16string non_ascii = u"Se\u00f1or, ma\u00f1ana es s\u00e1bado";
+
+  // When
+  ConversionReport report;
+  std::vector<char> ascii_bytes = CppStrConv::u16_to_us_ascii_bytes(
+      non_ascii, report, UnmappablePolicy::Skip);
+  std::string result(ascii_bytes.begin(), ascii_bytes.end());
+
+  // Then
+  EXPECT_EQ(result, "Seor, maana es sbado");
+  EXPECT_EQ(report.unmappableCount, 3u);
+  EXPECT_EQ(report.firstUnmappable, 2u);
+}
+
+TEST(CppStrConvTest, u16_to_us_ascii_bytes_ThrowPolicy) {
+  // Given
+  std::u16string non_ascii = u"Hello, \u00f1";
+  ConversionReport report;
+
+  // When/Then
+  EXPECT_THROW(CppStrConv::u16_to_us_ascii_bytes(non_ascii, report,
+                                                 UnmappablePolicy::Throw),
+               std::invalid_argument);
+  EXPECT_EQ(report.firstUnmappable, 7u);
+}
+
 TEST(CppStrConvTest, u32_bytes_to_u32_InvalidLength) {
   // Given
   std::vector<char> invalid_input = {0x00, 0x00, 0x00};
@@ -129,6 +345,26 @@ TEST(CppStrConvTest, u32_to_u8_InvalidU32) {
   EXPECT_THROW(CppStrConv::u32_to_u8(invalid_utf32), std::invalid_argument);
 }
 
+TEST(CppStrConvTest, u32_to_u8_truncated_InvalidU32) {
+  // Given
+  std::u32string invalid_utf32 = {0x41, 0x110000};  // Above U+10FFFF
+  size_t consumed = 0;
+
+  // When/Then
+  EXPECT_THROW(CppStrConv::u32_to_u8_truncated(invalid_utf32, 10, consumed),
+               std::invalid_argument);
+}
+
+TEST(CppStrConvTest, u32_to_u8_truncated_Surrogate) {
+  // Given
+  std::u32string surrogate = {0x41, 0xD800};
+  size_t consumed = 0;
+
+  // When/Then
+  EXPECT_THROW(CppStrConv::u32_to_u8_truncated(surrogate, 10, consumed),
+               std::invalid_argument);
+}
+
 TEST(CppStrConvTest, u32_to_u8_Success) {
   // Given
   std::u32string utf32_str = U"Hello, 안녕하세요, こんにちは, 你好, 😘";
@@ -177,6 +413,20 @@ TEST(CppStrConvTest, u8_to_u16_Success) {
   EXPECT_EQ(utf16_str, expected);
 }
 
+TEST(CppStrConvTest, u8_to_u16_truncated_SurrogatePair) {
+  // Given
+  std::string utf8_str = "\xF0\x9F\x98\x80\xF0\x9F\x98\x80";  // '😀😀'
+  size_t consumed = 0;
+
+  // When
+  std::u16string result =
+      CppStrConv::u8_to_u16_truncated(utf8_str, 3, consumed);
+
+  // Then
+  EXPECT_EQ(result, u"\U0001F600");
+  EXPECT_EQ(consumed, 4u);
+}
+
 TEST(CppStrConvTest, u8_bytes_to_u16_InvalidBOM) {
   // Given
   std::vector<char> invalid_utf16_bom = {'\xfe', '\xff'};
@@ -186,4 +436,58 @@ TEST(CppStrConvTest, u8_bytes_to_u16_InvalidBOM) {
                std::invalid_argument);
 }
 
+TEST(CppStrConvTest, us_ascii_bytes_to_u16_HighBytes) {
+  // Given
+  std::vector<char> input = {'A', '\x80', '\xff'};
+
+  // When
+  std::u16string result = CppStrConv::us_ascii_bytes_to_u16(input);
+
+  // Then
+  EXPECT_EQ(result, u"A??");
+}
+
+TEST(CppStrConvTest, us_ascii_bytes_to_u16_Report) {
+  // Given
+  std::vector<char> input = {'P', 'l', 'a', 'i', 'n', ' ', 'A', 'S', 'C',
+                             'I', 'I', ' ', 'w', 'i', 't', 'h', ' ', '\xe9'};
+
+  // When
+  ConversionReport report;
+  std::u16string result = CppStrConv::us_ascii_bytes_to_u16(input, report);
+
+  // Then
+  EXPECT_EQ(result, u"Plain ASCII with ?");
+  EXPECT_EQ(report.unmappableCount, 1u);
+  EXPECT_EQ(report.firstUnmappable, 17u);
+}
+
+TEST(CppStrConvTest, us_ascii_bytes_to_u16_SkipPolicy) {
+  // Given
+  std::vector<char> input(20, 'a');
+  input[18] = '\xe9';
+
+  // When
+  ConversionReport report;
+  std::u16string result = CppStrConv::us_ascii_bytes_to_u16(
+      input, report, UnmappablePolicy::Skip);
+
+  // Then
+  EXPECT_EQ(result, std::u16string(19, u'a'));
+  EXPECT_EQ(report.unmappableCount, 1u);
+  EXPECT_EQ(report.firstUnmappable, 18u);
+}
+
+TEST(CppStrConvTest, us_ascii_bytes_to_u16_ThrowPolicy) {
+  // Given
+  std::vector<char> input = {'a', '\xe9'};
+  ConversionReport report;
+
+  // When/Then
+  EXPECT_THROW(
+      CppStrConv::us_ascii_bytes_to_u16(input, report, UnmappablePolicy::Throw),
+      std::invalid_argument);
+  EXPECT_EQ(report.firstUnmappable, 1u);
+}
+
 }  // namespace bene